@@ -51,4 +51,14 @@ endif()
 
 
 target_include_directories("${EXE_NAME}" PRIVATE ${RAYGUI_INCLUDE_DIRS})
-target_link_libraries("${EXE_NAME}" PRIVATE raylib raylib_cpp fmt::fmt)
\ No newline at end of file
+target_link_libraries("${EXE_NAME}" PRIVATE raylib raylib_cpp fmt::fmt)
+
+## Threads (board generation and seed search)
+if (NOT EMSCRIPTEN)
+    find_package(Threads REQUIRED)
+    target_link_libraries("${EXE_NAME}" PRIVATE Threads::Threads)
+endif()
+
+if (TARGET "${SEED_SEARCH_EXE_NAME}")
+    target_link_libraries("${SEED_SEARCH_EXE_NAME}" PRIVATE fmt::fmt Threads::Threads)
+endif()
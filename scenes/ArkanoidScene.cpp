@@ -2,6 +2,7 @@
 #include <array>
 #include <fmt/format.h>
 #include "../tools/PhraseEncoder.h"
+#include "../tools/BoardGenerator.h"
 
 #include "ArkanoidScene.h"
 
@@ -34,11 +35,13 @@ namespace {
 namespace maslo {
     ArkanoidScene::ArkanoidScene(size_t fieldWidth, size_t fieldHeight)
         : m_automata(fieldWidth, fieldHeight, CellAutomataRules::make34Life()),
+        m_history(fieldWidth, fieldHeight),
         m_fieldWidth(fieldWidth), m_fieldHeight(fieldHeight) {}
 
     void ArkanoidScene::update(float dt) {
         // Handle input
         const auto& keys = KeyboardInputHandler::getRawKeys();
+        bool rewindPressed = false;
         for (auto key : keys) {
             if (key == KeyboardKey::KEY_SPACE && !m_gameStarted) {
                 m_gameStarted = true;
@@ -51,7 +54,16 @@ namespace maslo {
             else if (key == KeyboardKey::KEY_RIGHT) {
                 padX += padVelocity / 1000.f * dt;
             }
+            else if (key == KeyboardKey::KEY_BACKSPACE) {
+                rewindPressed = true;
+            }
+        }
+
+        // Keys stay in the list while held, so rewind once per press
+        if (rewindPressed && !m_rewindHeld) {
+            rewindBoard();
         }
+        m_rewindHeld = rewindPressed;
 
         if (keys.empty()) {
             const auto& touches = TouchInputHandler::getRawTouches();
@@ -88,6 +100,7 @@ namespace maslo {
         auto cellTicksElapsed = static_cast<int>(m_dtSinceCellUpdate / cellUpdateTime);
         if (cellTicksElapsed > 0) {
             while (cellTicksElapsed--) {
+                m_history.push(m_automata.getField(), m_automata.getGeneration());
                 m_automata.update();
             }
             m_dtSinceCellUpdate = 0;
@@ -100,29 +113,10 @@ namespace maslo {
 
         // TODO: Load seed?
         maslo::PhraseEncoder enc;
-        std::vector<uint8_t> seedBytes{
-            static_cast<unsigned char>(seed >> 24),
-            static_cast<unsigned char>((seed >> 16) & 0xFF),
-            static_cast<unsigned char>((seed >> 8) & 0xFF),
-            static_cast<unsigned char>(seed & 0xFF)
-        };
-        m_seed = enc.encode(seedBytes);
-
-        std::mt19937 gen(seed);
-        std::uniform_int_distribution<> distrib(1, 1000000);
-
-        std::vector<uint8_t> rawField;
-        rawField.reserve(m_fieldHeight * m_fieldWidth);
-
-        for (int i = 0; i < m_fieldHeight; ++i) {
-            for (int j = 0; j < m_fieldWidth; ++j) {
-                auto state = distrib(gen) > static_cast<int>(distrib.max() * (1 - cellSpawnProbability));
-                rawField.push_back(state);
-                if (state) {
-                    m_automata.setCell(j, i, 1);
-                }
-            }
-        }
+        m_seed = enc.encodeSeed(seed);
+
+        m_automata.initMap(BoardGenerator(seed, cellSpawnProbability).generate(m_fieldWidth, m_fieldHeight));
+        m_history.clear();
 
         resetGame();
     }
@@ -236,4 +230,15 @@ namespace maslo {
         ballVX = 0.f;
         ballVY = 0.f;
     }
+
+    void ArkanoidScene::rewindBoard() {
+        auto generation = m_automata.getGeneration();
+        if (generation == 0) {
+            return;
+        }
+        if (auto field = m_history.seek(generation - 1)) {
+            m_automata.restore(*field, generation - 1);
+            m_dtSinceCellUpdate = 0;
+        }
+    }
 }
\ No newline at end of file
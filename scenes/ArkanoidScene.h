@@ -5,6 +5,7 @@
 #include "../input/KeyboardInputHandler.h"
 #include "../input/TouchInputHandler.h"
 #include "../tools/CellAutomata.h"
+#include "../tools/GenerationHistory.h"
 
 namespace maslo {
     class ArkanoidScene : public BaseScene, public KeyboardInputHandler, public TouchInputHandler {
@@ -19,8 +20,10 @@ namespace maslo {
         std::optional<std::pair<int, int>> WorldXYToCellXY(int x, int y);
         void handleCollisions();
         void resetGame();
+        void rewindBoard();
     private:
         CellAutomata m_automata;
+        GenerationHistory m_history;
         std::string m_seed;
         size_t m_fieldWidth, m_fieldHeight;
         float padX = 0;
@@ -28,5 +31,6 @@ namespace maslo {
         float ballVX = 0, ballVY = 0;
         float m_dtSinceCellUpdate = 0.f;
         bool m_gameStarted = false;
+        bool m_rewindHeld = false;
     };
 }
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include <cstdio>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <fmt/format.h>
+#include <fmt/os.h>
+
+#include "tools/PhraseEncoder.h"
+#include "tools/SeedSearch.h"
+
+// Headless level finder: scores a range of board seeds on all cores and prints the best ones.
+
+namespace {
+    void printUsage(const char* argv0) {
+        fmt::print(
+                "Usage: {} [options]\n"
+                "  --from N             first seed (default 0)\n"
+                "  --count N            number of seeds to evaluate (default 100000)\n"
+                "  --top N              number of best seeds to report (default 10)\n"
+                "  --threads N          worker threads, 0 for all cores (default 0)\n"
+                "  --size WxH           field size (default 25x25)\n"
+                "  --rules R            Life-like ruleset (default B34/S34)\n"
+                "  --spawn P            cell spawn probability (default 0.15)\n"
+                "  --generations N      generations to simulate per seed (default 500)\n"
+                "  --w-lifetime X       lifetime weight (default 1)\n"
+                "  --w-density X        density weight (default 1)\n"
+                "  --target-density X   desired mean brick density (default 0.15)\n"
+                "  --min-lifetime N     boards stabilizing earlier are penalized (default 50)\n"
+                "  --early-penalty X    penalty for early stabilization (default 1)\n"
+                "  --csv PATH           also write results as CSV\n",
+                argv0
+        );
+    }
+
+    size_t parseUnsigned(std::string_view option, const std::string& value) {
+        // std::stoull silently wraps negative numbers
+        try {
+            size_t pos = 0;
+            if (!value.empty() && value.front() != '-') {
+                auto result = std::stoull(value, &pos);
+                if (pos == value.size()) {
+                    return result;
+                }
+            }
+        }
+        catch (const std::logic_error&) {}
+        throw std::runtime_error(fmt::format("Incorrect value '{}' for '{}'; expected a non-negative integer", value, option));
+    }
+
+    float parseFloat(std::string_view option, const std::string& value) {
+        try {
+            size_t pos = 0;
+            auto result = std::stof(value, &pos);
+            if (pos == value.size()) {
+                return result;
+            }
+        }
+        catch (const std::logic_error&) {}
+        throw std::runtime_error(fmt::format("Incorrect value '{}' for '{}'; expected a number", value, option));
+    }
+
+    // std::nullopt means help was requested
+    std::optional<maslo::SeedSearchConfig> parseArgs(int argc, char** argv, std::string& csvPath) {
+        maslo::SeedSearchConfig config;
+
+        for (int i = 1; i < argc; ++i) {
+            std::string_view arg = argv[i];
+            if (arg == "--help" || arg == "-h") {
+                return std::nullopt;
+            }
+            if (i + 1 >= argc) {
+                throw std::runtime_error(fmt::format("Missing value for '{}'", arg));
+            }
+            std::string value = argv[++i];
+
+            if (arg == "--from") {
+                config.firstSeed = parseUnsigned(arg, value);
+            }
+            else if (arg == "--count") {
+                config.seedCount = parseUnsigned(arg, value);
+            }
+            else if (arg == "--top") {
+                config.topCount = parseUnsigned(arg, value);
+            }
+            else if (arg == "--threads") {
+                config.threadCount = parseUnsigned(arg, value);
+            }
+            else if (arg == "--size") {
+                auto x = value.find('x');
+                if (x == std::string::npos) {
+                    throw std::runtime_error(fmt::format("Incorrect field size '{}'", value));
+                }
+                config.fieldWidth = parseUnsigned(arg, value.substr(0, x));
+                config.fieldHeight = parseUnsigned(arg, value.substr(x + 1));
+            }
+            else if (arg == "--rules") {
+                config.rules = value;
+            }
+            else if (arg == "--spawn") {
+                config.spawnProbability = parseFloat(arg, value);
+            }
+            else if (arg == "--generations") {
+                config.maxGenerations = parseUnsigned(arg, value);
+            }
+            else if (arg == "--w-lifetime") {
+                config.lifetimeWeight = parseFloat(arg, value);
+            }
+            else if (arg == "--w-density") {
+                config.densityWeight = parseFloat(arg, value);
+            }
+            else if (arg == "--target-density") {
+                config.targetDensity = parseFloat(arg, value);
+            }
+            else if (arg == "--min-lifetime") {
+                config.minLifetime = parseUnsigned(arg, value);
+            }
+            else if (arg == "--early-penalty") {
+                config.earlyStabilizationPenalty = parseFloat(arg, value);
+            }
+            else if (arg == "--csv") {
+                csvPath = value;
+            }
+            else {
+                throw std::runtime_error(fmt::format("Unknown option '{}'", arg));
+            }
+        }
+
+        return config;
+    }
+}
+
+int main(int argc, char** argv) {
+    try {
+        std::string csvPath;
+        auto config = parseArgs(argc, argv, csvPath);
+        if (!config) {
+            printUsage(argv[0]);
+            return 0;
+        }
+        auto result = maslo::SeedSearch(*config).run();
+
+        maslo::PhraseEncoder enc;
+        fmt::print("{:>4} {:>10} {:>8} {:>8} {:>6} {:>7}  {}\n", "#", "seed", "score", "lifetime", "period", "density", "phrase");
+        for (size_t i = 0; i < result.top.size(); ++i) {
+            const auto& s = result.top[i];
+            fmt::print("{:>4} {:>10} {:>8.4f} {:>8} {:>6} {:>7.4f}  {}\n",
+                       i + 1, s.seed, s.score, s.lifetime, s.period, s.meanDensity, enc.encodeSeed(s.seed));
+        }
+
+        auto seedsPerSecond = result.seconds > 0. ? static_cast<double>(result.evaluated) / result.seconds : 0.;
+        fmt::print("Evaluated {} seeds in {:.3f} s ({:.0f} seeds/s)\n", result.evaluated, result.seconds, seedsPerSecond);
+
+        if (!csvPath.empty()) {
+            auto out = fmt::output_file(csvPath);
+            out.print("seed,score,lifetime,period,density,phrase\n");
+            for (const auto& s : result.top) {
+                out.print("{},{},{},{},{},{}\n", s.seed, s.score, s.lifetime, s.period, s.meanDensity, enc.encodeSeed(s.seed));
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        fmt::print(stderr, "Error: {}\n", e.what());
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include "BoardGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace {
+    // Regions smaller than this are filled on the calling thread; a 25x25 level never spawns threads
+    constexpr size_t parallelCellThreshold = 1 << 18;
+}
+
+namespace maslo {
+    BoardGenerator::BoardGenerator(uint32_t seed, float spawnProbability)
+        : m_seedKey(mix(seed ^ 0xA511E9B3u)) {
+        auto p = std::clamp(static_cast<double>(spawnProbability), 0., 1.);
+        // 2^32 does not fit, so p == 1 loses a single hash value out of 2^32
+        m_threshold = static_cast<uint32_t>(std::min(std::ldexp(p, 32), 4294967295.));
+    }
+
+    void BoardGenerator::fillRows(uint32_t x, uint32_t y, size_t width, size_t rowCount, uint8_t* __restrict out) const {
+        // Local copy so stores to `out` cannot alias it and the loop needs no runtime aliasing check
+        const auto threshold = m_threshold;
+        for (size_t i = 0; i < rowCount; ++i) {
+            auto key = rowKey(y + static_cast<uint32_t>(i));
+            uint8_t* __restrict row = out + i * width;
+            // Branch-free on purpose, keep it that way so the compiler can vectorize it
+            for (size_t j = 0; j < width; ++j) {
+                row[j] = cellHash(key, x + static_cast<uint32_t>(j)) < threshold;
+            }
+        }
+    }
+
+    void BoardGenerator::fillRegion(int32_t x, int32_t y, size_t width, size_t height, uint8_t* out) const {
+        size_t threadCount = 1;
+#if !defined(__EMSCRIPTEN__)
+        if (width * height >= parallelCellThreshold) {
+            threadCount = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), height);
+        }
+#endif
+
+        auto x0 = static_cast<uint32_t>(x);
+        auto y0 = static_cast<uint32_t>(y);
+
+        if (threadCount <= 1) {
+            fillRows(x0, y0, width, height, out);
+            return;
+        }
+
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+        auto rowsPerThread = (height + threadCount - 1) / threadCount;
+        for (size_t first = rowsPerThread; first < height; first += rowsPerThread) {
+            auto count = std::min(rowsPerThread, height - first);
+            threads.emplace_back(&BoardGenerator::fillRows, this,
+                                 x0, y0 + static_cast<uint32_t>(first), width, count,
+                                 out + first * width);
+        }
+        fillRows(x0, y0, width, std::min(rowsPerThread, height), out);
+        for (auto& t : threads) {
+            t.join();
+        }
+    }
+
+    std::vector<std::vector<uint8_t>> BoardGenerator::generate(size_t width, size_t height) const {
+        std::vector<uint8_t> field(width * height);
+        fillRegion(0, 0, width, height, field.data());
+
+        std::vector<std::vector<uint8_t>> map;
+        map.reserve(height);
+        for (size_t i = 0; i < height; ++i) {
+            map.emplace_back(field.begin() + static_cast<ptrdiff_t>(i * width),
+                             field.begin() + static_cast<ptrdiff_t>((i + 1) * width));
+        }
+        return map;
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace maslo {
+    /**
+     * Counter-based board generator: the state of cell (x, y) is a pure function of the seed and
+     * its coordinates, so any region of an unbounded world can be (re)generated on demand,
+     * in any order and in parallel, and always matches the level restored from the same phrase.
+     */
+    class BoardGenerator {
+    public:
+        BoardGenerator(uint32_t seed, float spawnProbability);
+
+        [[nodiscard]] bool isAlive(int32_t x, int32_t y) const {
+            return cellHash(rowKey(static_cast<uint32_t>(y)), static_cast<uint32_t>(x)) < m_threshold;
+        }
+
+        /**
+         * Writes the `width * height` region starting at (x, y) to `out` in row-major order.
+         * Large regions are split by rows between threads.
+         */
+        void fillRegion(int32_t x, int32_t y, size_t width, size_t height, uint8_t* out) const;
+
+        /**
+         * Board with its top left corner at (0, 0), in the format expected by `CellAutomata::initMap()`
+         */
+        [[nodiscard]] std::vector<std::vector<uint8_t>> generate(size_t width, size_t height) const;
+    private:
+        // murmur3 finalizer; 32-bit only, so the per-row loop vectorizes (SSE2+/wasm simd128, see CMakeLists.txt)
+        static constexpr uint32_t mix(uint32_t h) {
+            h ^= h >> 16;
+            h *= 0x85EBCA6Bu;
+            h ^= h >> 13;
+            h *= 0xC2B2AE35u;
+            h ^= h >> 16;
+            return h;
+        }
+
+        // Coordinates wrap modulo 2^32, so regions may cross INT32_MAX
+        [[nodiscard]] uint32_t rowKey(uint32_t y) const {
+            return mix(m_seedKey ^ mix(y * 0x9E3779B9u + 0x7F4A7C15u));
+        }
+
+        static uint32_t cellHash(uint32_t rowKey, uint32_t x) {
+            return mix(rowKey ^ (x * 0x9E3779B9u));
+        }
+
+        void fillRows(uint32_t x, uint32_t y, size_t width, size_t rowCount, uint8_t* __restrict out) const;
+    private:
+        uint32_t m_seedKey;
+        uint32_t m_threshold; // cell is alive if its hash is below this
+    };
+}
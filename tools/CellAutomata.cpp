@@ -3,7 +3,6 @@
 #include <utility>
 #include <stdexcept>
 #include <array>
-#include <numeric>
 #include <fmt/format.h>
 
 namespace maslo {
@@ -82,6 +81,14 @@ namespace maslo {
         : m_width(width), m_height(height), m_rules(std::move(rules)), m_generation(0) {
         m_field.reserve(m_width * m_height);
         m_field.assign(m_width * m_height, 0);
+        m_nextField.assign(m_width * m_height, 0);
+
+        for (auto n : m_rules.getBirthCondition()) {
+            m_birthTable.at(n) = true;
+        }
+        for (auto n : m_rules.getSurvivalCondition()) {
+            m_survivalTable.at(n) = true;
+        }
     }
 
     void CellAutomata::initMap(const std::vector<std::vector<uint8_t>> &map) {
@@ -110,6 +117,20 @@ namespace maslo {
         }
     }
 
+    void CellAutomata::restore(const std::vector<uint8_t>& field, size_t generation) {
+        if (field.size() != m_width * m_height) {
+            throw std::runtime_error(
+                    fmt::format(
+                            "Field size mismatch; expected {}, got {}",
+                            m_width * m_height, field.size()
+                    )
+            );
+        }
+
+        m_field = field;
+        m_generation = generation;
+    }
+
     uint8_t CellAutomata::getCell(int x, int y) const {
         checkBorder(x, 0, static_cast<int>(m_width - 1));
         checkBorder(y, 0, static_cast<int>(m_height - 1));
@@ -132,36 +153,48 @@ namespace maslo {
     }
 
     void CellAutomata::update() {
-        auto newGen = m_field;
-        std::array<uint8_t, 8> neighbors{};
-
-        // Inefficient (O(W*H) memory) and P R O U D
-
-        for (auto i = 0; i < m_height; ++i) {
-            for (auto j = 0; j < m_width; ++j) {
-                neighbors = {
-                        getCell(j - 1, i - 1), getCell(j, i - 1), getCell(j + 1, i - 1),
-                        getCell(j - 1, i), /* neighbors only, */ getCell(j + 1, i),
-                        getCell(j - 1, i + 1), getCell(j, i + 1), getCell(j + 1, i + 1)
-                        };
-                auto s = std::accumulate(neighbors.cbegin(), neighbors.cend(), 0, [](int a, int b) {
-                    return a + (b != 0);
-                });
-                auto isAlive = getCell(j, i) != 0;
-                if (!m_rules.getSurvivalCondition().contains(s) && isAlive) {
-                    newGen[i * m_width + j] = 0;
+        // Still O(W*H) memory, but the back buffer is reused between generations
+        // and wrapping is resolved once per row/column instead of per neighbor.
+
+        for (size_t i = 0; i < m_height; ++i) {
+            const auto* up = &m_field[(i == 0 ? m_height - 1 : i - 1) * m_width];
+            const auto* row = &m_field[i * m_width];
+            const auto* down = &m_field[(i == m_height - 1 ? 0 : i + 1) * m_width];
+            auto* out = &m_nextField[i * m_width];
+
+            for (size_t j = 0; j < m_width; ++j) {
+                auto l = j == 0 ? m_width - 1 : j - 1;
+                auto r = j == m_width - 1 ? 0 : j + 1;
+                auto s = (up[l] != 0) + (up[j] != 0) + (up[r] != 0) +
+                         (row[l] != 0) + /* neighbors only, */ (row[r] != 0) +
+                         (down[l] != 0) + (down[j] != 0) + (down[r] != 0);
+                auto isAlive = row[j] != 0;
+                if (isAlive) {
+                    out[j] = m_survivalTable[s] ? row[j] : 0;
                 }
-                if (m_rules.getBirthCondition().contains(s) && !isAlive) {
-                    newGen[i * m_width + j] = 1;
+                else {
+                    out[j] = m_birthTable[s] ? 1 : 0;
                 }
             }
         }
 
-        m_field = newGen;
+        m_field.swap(m_nextField);
         ++m_generation;
     }
 
     size_t CellAutomata::getGeneration() const {
         return m_generation;
     }
+
+    size_t CellAutomata::getWidth() const {
+        return m_width;
+    }
+
+    size_t CellAutomata::getHeight() const {
+        return m_height;
+    }
+
+    const std::vector<uint8_t>& CellAutomata::getField() const {
+        return m_field;
+    }
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <set>
@@ -27,17 +29,31 @@ namespace maslo {
         CellAutomata(size_t width, size_t height, CellAutomataRules rules = CellAutomataRules::makeClassicLife());
 
         void initMap(const std::vector<std::vector<uint8_t>>& map);
+        /**
+         * Replaces the whole field (row-major, as returned by `getField()`) and the generation counter
+         */
+        void restore(const std::vector<uint8_t>& field, size_t generation);
         [[nodiscard]] uint8_t getCell(int x, int y) const;
         void setCell(int x, int y, uint8_t value);
 
         void update();
 
         [[nodiscard]] size_t getGeneration() const;
+        [[nodiscard]] size_t getWidth() const;
+        [[nodiscard]] size_t getHeight() const;
+        /**
+         * Row-major view of the whole field, `width * height` cells
+         */
+        [[nodiscard]] const std::vector<uint8_t>& getField() const;
     private:
         static void checkBorder(int& coordinate, int min, int max);
     private:
         CellAutomataRules m_rules;
+        // Neighbor count -> next state, built from m_rules once
+        std::array<bool, 10> m_birthTable{};
+        std::array<bool, 10> m_survivalTable{};
         std::vector<uint8_t> m_field;
+        std::vector<uint8_t> m_nextField;
         size_t m_width;
         size_t m_height;
         size_t m_generation;
@@ -0,0 +1,214 @@
+#include "GenerationHistory.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <fmt/format.h>
+
+namespace {
+    void writeVarint(std::vector<uint8_t>& out, size_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    size_t readVarint(const std::vector<uint8_t>& in, size_t& pos) {
+        size_t value = 0;
+        int shift = 0;
+        uint8_t byte;
+        do {
+            byte = in.at(pos++);
+            value |= static_cast<size_t>(byte & 0x7F) << shift;
+            shift += 7;
+        }
+        while (byte & 0x80);
+        return value;
+    }
+}
+
+namespace maslo {
+    GenerationHistory::GenerationHistory(size_t width, size_t height, size_t keyframeInterval, size_t memoryBudget)
+        : m_cellCount(width * height), m_keyframeInterval(std::max<size_t>(keyframeInterval, 1)),
+        m_memoryBudget(memoryBudget) {}
+
+    void GenerationHistory::push(const std::vector<uint8_t>& field, size_t generation) {
+        if (field.size() != m_cellCount) {
+            throw std::runtime_error(
+                    fmt::format("Field size mismatch; expected {}, got {}", m_cellCount, field.size())
+            );
+        }
+
+        if (!m_frames.empty() && generation > m_oldestGeneration && generation <= newestGeneration()) {
+            truncate(generation);
+        }
+        if (!m_frames.empty() && generation != newestGeneration() + 1) {
+            clear();
+        }
+        if (m_frames.empty()) {
+            m_oldestGeneration = generation;
+        }
+
+        pack(field, m_packed);
+
+        Frame frame;
+        frame.isKeyframe = m_frames.empty() || m_sinceKeyframe + 1 >= m_keyframeInterval;
+        if (frame.isKeyframe) {
+            frame.data = m_packed;
+            m_sinceKeyframe = 0;
+            ++m_keyframeCount;
+        }
+        else {
+            encodeDelta(m_packed, m_last, frame.data);
+            ++m_sinceKeyframe;
+        }
+
+        m_framesMemoryUsage += sizeof(Frame) + frame.data.capacity();
+        m_frames.push_back(std::move(frame));
+        m_last.swap(m_packed);
+
+        // Never drop the segment the newest generation depends on
+        while (getMemoryUsage() > m_memoryBudget && m_keyframeCount > 1) {
+            evictOldest();
+        }
+    }
+
+    std::optional<std::vector<uint8_t>> GenerationHistory::seek(size_t generation) const {
+        if (m_frames.empty() || generation < m_oldestGeneration || generation > newestGeneration()) {
+            return std::nullopt;
+        }
+        if (generation == newestGeneration()) {
+            return unpack(m_last);
+        }
+
+        return unpack(decode(generation - m_oldestGeneration));
+    }
+
+    void GenerationHistory::clear() {
+        m_frames.clear();
+        m_last.clear();
+        m_framesMemoryUsage = 0;
+        m_sinceKeyframe = 0;
+        m_keyframeCount = 0;
+        m_oldestGeneration = 0;
+    }
+
+    bool GenerationHistory::empty() const {
+        return m_frames.empty();
+    }
+
+    std::optional<size_t> GenerationHistory::getOldestGeneration() const {
+        if (m_frames.empty()) {
+            return std::nullopt;
+        }
+        return m_oldestGeneration;
+    }
+
+    std::optional<size_t> GenerationHistory::getNewestGeneration() const {
+        if (m_frames.empty()) {
+            return std::nullopt;
+        }
+        return newestGeneration();
+    }
+
+    size_t GenerationHistory::getMemoryUsage() const {
+        return m_framesMemoryUsage + m_last.capacity() + m_packed.capacity();
+    }
+
+    size_t GenerationHistory::newestGeneration() const {
+        return m_oldestGeneration + m_frames.size() - 1;
+    }
+
+    std::vector<uint8_t> GenerationHistory::decode(size_t index) const {
+        auto keyframe = index;
+        while (!m_frames[keyframe].isKeyframe) {
+            --keyframe;
+        }
+
+        auto bits = m_frames[keyframe].data;
+        for (auto i = keyframe + 1; i <= index; ++i) {
+            applyDelta(m_frames[i].data, bits);
+        }
+        return bits;
+    }
+
+    void GenerationHistory::truncate(size_t generation) {
+        // Drops `generation` and everything newer; the oldest generation is always kept
+        while (newestGeneration() >= generation) {
+            const auto& back = m_frames.back();
+            m_framesMemoryUsage -= sizeof(Frame) + back.data.capacity();
+            m_keyframeCount -= back.isKeyframe;
+            m_frames.pop_back();
+        }
+
+        m_sinceKeyframe = 0;
+        for (auto it = m_frames.crbegin(); !it->isKeyframe; ++it) {
+            ++m_sinceKeyframe;
+        }
+        m_last = decode(m_frames.size() - 1);
+    }
+
+    void GenerationHistory::pack(const std::vector<uint8_t>& field, std::vector<uint8_t>& out) const {
+        out.assign((m_cellCount + 7) / 8, 0);
+        for (size_t i = 0; i < m_cellCount; ++i) {
+            out[i / 8] |= static_cast<uint8_t>((field[i] != 0) << (i % 8));
+        }
+    }
+
+    std::vector<uint8_t> GenerationHistory::unpack(const std::vector<uint8_t>& bits) const {
+        std::vector<uint8_t> field(m_cellCount);
+        for (size_t i = 0; i < m_cellCount; ++i) {
+            field[i] = (bits[i / 8] >> (i % 8)) & 1;
+        }
+        return field;
+    }
+
+    void GenerationHistory::encodeDelta(const std::vector<uint8_t>& bits, const std::vector<uint8_t>& prevBits,
+                                        std::vector<uint8_t>& out) {
+        // (unchanged bytes, changed bytes, XOR of the changed bytes) triples
+        const auto size = bits.size();
+        size_t i = 0;
+        while (i < size) {
+            auto start = i;
+            while (i < size && bits[i] == prevBits[i]) {
+                ++i;
+            }
+            if (i == size) {
+                break;
+            }
+            auto changedStart = i;
+            while (i < size && bits[i] != prevBits[i]) {
+                ++i;
+            }
+
+            writeVarint(out, changedStart - start);
+            writeVarint(out, i - changedStart);
+            for (auto j = changedStart; j < i; ++j) {
+                out.push_back(bits[j] ^ prevBits[j]);
+            }
+        }
+        out.shrink_to_fit();
+    }
+
+    void GenerationHistory::applyDelta(const std::vector<uint8_t>& delta, std::vector<uint8_t>& bits) {
+        size_t pos = 0;
+        size_t byte = 0;
+        while (pos < delta.size()) {
+            byte += readVarint(delta, pos);
+            auto changed = readVarint(delta, pos);
+            for (size_t j = 0; j < changed; ++j) {
+                bits.at(byte++) ^= delta.at(pos++);
+            }
+        }
+    }
+
+    void GenerationHistory::evictOldest() {
+        --m_keyframeCount;
+        do {
+            m_framesMemoryUsage -= sizeof(Frame) + m_frames.front().data.capacity();
+            m_frames.pop_front();
+            ++m_oldestGeneration;
+        }
+        while (!m_frames.empty() && !m_frames.front().isKeyframe);
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <vector>
+
+namespace maslo {
+    /**
+     * Bounded history of automata fields for consecutive generations.
+     * Cells are kept as alive/dead bits; every `keyframeInterval`-th generation is stored whole,
+     * the rest as run-length encoded XOR deltas against the previous generation.
+     * When the memory budget (stored frames plus the working buffers) is exceeded, the oldest keyframe
+     * together with its deltas is dropped; the newest keyframe segment is always kept.
+     */
+    class GenerationHistory {
+    public:
+        GenerationHistory(size_t width, size_t height, size_t keyframeInterval = 32, size_t memoryBudget = 256 * 1024);
+
+        /**
+         * Records `field` as `generation`. Recorded generations from `generation` on are replaced
+         * (e.g. after a rewind); any other gap starts the history over.
+         */
+        void push(const std::vector<uint8_t>& field, size_t generation);
+        /**
+         * Field of `generation`, with alive cells set to 1; `std::nullopt` if it is not in the history
+         */
+        [[nodiscard]] std::optional<std::vector<uint8_t>> seek(size_t generation) const;
+        void clear();
+
+        [[nodiscard]] bool empty() const;
+        // std::nullopt if the history is empty
+        [[nodiscard]] std::optional<size_t> getOldestGeneration() const;
+        [[nodiscard]] std::optional<size_t> getNewestGeneration() const;
+        [[nodiscard]] size_t getMemoryUsage() const;
+    private:
+        struct Frame {
+            bool isKeyframe;
+            std::vector<uint8_t> data;
+        };
+
+        [[nodiscard]] size_t newestGeneration() const; // requires !m_frames.empty()
+        [[nodiscard]] std::vector<uint8_t> decode(size_t index) const;
+        void truncate(size_t generation);
+        void pack(const std::vector<uint8_t>& field, std::vector<uint8_t>& out) const;
+        [[nodiscard]] std::vector<uint8_t> unpack(const std::vector<uint8_t>& bits) const;
+        static void encodeDelta(const std::vector<uint8_t>& bits, const std::vector<uint8_t>& prevBits, std::vector<uint8_t>& out);
+        static void applyDelta(const std::vector<uint8_t>& delta, std::vector<uint8_t>& bits);
+        void evictOldest();
+    private:
+        size_t m_cellCount;
+        size_t m_keyframeInterval;
+        size_t m_memoryBudget;
+        size_t m_framesMemoryUsage = 0;
+        size_t m_oldestGeneration = 0;
+        size_t m_sinceKeyframe = 0;
+        size_t m_keyframeCount = 0;
+        std::deque<Frame> m_frames;
+        std::vector<uint8_t> m_last; // newest packed field, base for the next delta
+        std::vector<uint8_t> m_packed; // scratch buffer
+    };
+}
@@ -1,8 +1,12 @@
 #pragma once
 
 #include <array>
+#include <climits>
+#include <cstdint>
 #include <vector>
 #include <string>
+#include <string_view>
+#include <fmt/format.h>
 
 namespace maslo {
     constexpr std::array<const char *, 16> DEFAULT_PHRASES {
@@ -92,6 +96,18 @@ namespace maslo {
             }
             return result;
         }
+
+        /**
+         * Encodes a 32-bit board seed, most significant byte first
+         */
+        std::string encodeSeed(uint32_t seed) {
+            return encode({
+                static_cast<uint8_t>(seed >> 24),
+                static_cast<uint8_t>((seed >> 16) & 0xFF),
+                static_cast<uint8_t>((seed >> 8) & 0xFF),
+                static_cast<uint8_t>(seed & 0xFF)
+            });
+        }
     private:
         std::array<const char*, 1 << PassphraseBitEntropy> m_phrases;
     };
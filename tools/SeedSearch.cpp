@@ -0,0 +1,210 @@
+#include "SeedSearch.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <fmt/format.h>
+#include "BoardGenerator.h"
+
+namespace {
+    // Seeds handed out to a worker at once; small enough to keep cores balanced near the end of a range
+    constexpr uint64_t seedChunkSize = 256;
+    constexpr uint64_t seedSpaceSize = uint64_t{1} << 32;
+    // Upper bound for an explicit --threads, as a multiple of the available cores
+    constexpr size_t maxThreadsPerCore = 4;
+
+    uint64_t hashField(const std::vector<uint8_t>& field) {
+        // FNV-1a
+        uint64_t hash = 14695981039346656037ull;
+        for (auto cell : field) {
+            hash ^= cell != 0;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    bool isBetter(const maslo::SeedScore& a, const maslo::SeedScore& b) {
+        if (a.score != b.score) {
+            return a.score > b.score;
+        }
+        return a.seed < b.seed;
+    }
+}
+
+namespace maslo {
+    SeedSearch::SeedSearch(SeedSearchConfig config)
+        : m_config(std::move(config)), m_rules(m_config.rules) {
+        if (!m_rules.isCorrect()) {
+            throw std::runtime_error(fmt::format("Incorrect ruleset '{}'", m_config.rules));
+        }
+        if (m_config.fieldWidth == 0 || m_config.fieldHeight == 0) {
+            throw std::runtime_error("Field must not be empty");
+        }
+        if (m_config.firstSeed >= seedSpaceSize || m_config.seedCount > seedSpaceSize - m_config.firstSeed) {
+            throw std::runtime_error(
+                    fmt::format(
+                            "Seed range [{}, {}) is out of 32-bit seed space",
+                            m_config.firstSeed, m_config.firstSeed + m_config.seedCount
+                    )
+            );
+        }
+        auto maxThreads = maxThreadsPerCore * std::max(1u, std::thread::hardware_concurrency());
+        if (m_config.threadCount > maxThreads) {
+            throw std::runtime_error(
+                    fmt::format("Too many threads: {}, at most {} allowed", m_config.threadCount, maxThreads)
+            );
+        }
+    }
+
+    SeedScore SeedSearch::evaluate(uint32_t seed, CellAutomata& automata) const {
+        SeedScore result{.seed = seed};
+
+        automata.initMap(BoardGenerator(seed, m_config.spawnProbability).generate(m_config.fieldWidth, m_config.fieldHeight));
+
+        const auto cellCount = static_cast<float>(m_config.fieldWidth * m_config.fieldHeight);
+        std::unordered_map<uint64_t, size_t> seenStates;
+        seenStates.reserve(m_config.maxGenerations + 1);
+
+        double densitySum = 0.;
+        size_t densitySamples = 0;
+        result.lifetime = m_config.maxGenerations;
+
+        for (size_t gen = 0; gen <= m_config.maxGenerations; ++gen) {
+            const auto& field = automata.getField();
+            auto alive = std::count_if(field.cbegin(), field.cend(), [](uint8_t c) { return c != 0; });
+            densitySum += static_cast<float>(alive) / cellCount;
+            ++densitySamples;
+
+            auto [it, inserted] = seenStates.try_emplace(hashField(field), gen);
+            if (!inserted) {
+                result.lifetime = it->second;
+                result.period = gen - it->second;
+                break;
+            }
+            if (alive == 0) {
+                result.lifetime = gen;
+                result.period = 1;
+                break;
+            }
+            if (gen != m_config.maxGenerations) {
+                automata.update();
+            }
+        }
+
+        result.meanDensity = static_cast<float>(densitySum / static_cast<double>(densitySamples));
+
+        auto lifetimeScore = m_config.maxGenerations == 0
+                ? 1.f
+                : static_cast<float>(result.lifetime) / static_cast<float>(m_config.maxGenerations);
+        auto densitySpread = std::max(m_config.targetDensity, 1.f - m_config.targetDensity);
+        auto densityScore = 1.f - std::abs(result.meanDensity - m_config.targetDensity) / densitySpread;
+
+        result.score = m_config.lifetimeWeight * lifetimeScore + m_config.densityWeight * densityScore;
+        if (result.period != 0 && result.lifetime < m_config.minLifetime) {
+            result.score -= m_config.earlyStabilizationPenalty;
+        }
+
+        return result;
+    }
+
+    SeedSearchResult SeedSearch::run() const {
+        auto threadCount = m_config.threadCount;
+        if (threadCount == 0) {
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        std::atomic<uint64_t> nextOffset{0};
+        std::vector<std::vector<SeedScore>> perThreadTop(threadCount);
+
+        // First failure of any worker; the others stop at their next chunk and it is rethrown after joining
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+        std::mutex errorMutex;
+        auto fail = [&]() {
+            std::lock_guard lock(errorMutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+            failed = true;
+        };
+
+        auto search = [&](std::vector<SeedScore>& top) {
+            // Each worker owns its automata and keeps a local min-heap of the best seeds, so no locking is needed
+            CellAutomata automata(m_config.fieldWidth, m_config.fieldHeight, m_rules);
+            auto worse = [](const SeedScore& a, const SeedScore& b) { return isBetter(a, b); };
+            top.reserve(static_cast<size_t>(std::min<uint64_t>(m_config.topCount, m_config.seedCount)));
+
+            while (!failed) {
+                auto offset = nextOffset.fetch_add(seedChunkSize, std::memory_order_relaxed);
+                if (offset >= m_config.seedCount) {
+                    break;
+                }
+                auto end = std::min(offset + seedChunkSize, m_config.seedCount);
+
+                for (auto i = offset; i < end; ++i) {
+                    auto score = evaluate(static_cast<uint32_t>(m_config.firstSeed + i), automata);
+                    if (top.size() < m_config.topCount) {
+                        top.push_back(score);
+                        std::push_heap(top.begin(), top.end(), worse);
+                    }
+                    else if (!top.empty() && isBetter(score, top.front())) {
+                        std::pop_heap(top.begin(), top.end(), worse);
+                        top.back() = score;
+                        std::push_heap(top.begin(), top.end(), worse);
+                    }
+                }
+            }
+        };
+
+        auto worker = [&](std::vector<SeedScore>& top) {
+            try {
+                search(top);
+            }
+            catch (...) {
+                fail();
+            }
+        };
+
+        auto startTime = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> threads;
+        try {
+            threads.reserve(threadCount - 1);
+            for (size_t i = 1; i < threadCount; ++i) {
+                threads.emplace_back(worker, std::ref(perThreadTop[i]));
+            }
+        }
+        catch (...) {
+            fail();
+        }
+        worker(perThreadTop[0]);
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        auto endTime = std::chrono::steady_clock::now();
+
+        SeedSearchResult result;
+        for (const auto& top : perThreadTop) {
+            result.top.insert(result.top.end(), top.cbegin(), top.cend());
+        }
+        std::sort(result.top.begin(), result.top.end(), isBetter);
+        if (result.top.size() > m_config.topCount) {
+            result.top.resize(m_config.topCount);
+        }
+        result.evaluated = m_config.seedCount;
+        result.seconds = std::chrono::duration<double>(endTime - startTime).count();
+
+        return result;
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "CellAutomata.h"
+
+namespace maslo {
+    struct SeedSearchConfig {
+        uint64_t firstSeed = 0;
+        uint64_t seedCount = 100000;
+        size_t topCount = 10;
+        size_t threadCount = 0; // 0 means std::thread::hardware_concurrency()
+
+        size_t fieldWidth = 25;
+        size_t fieldHeight = 25;
+        std::string rules = "B34/S34";
+        float spawnProbability = 0.15f;
+        size_t maxGenerations = 500;
+
+        // Metric weights; score = lifetime + density - early stabilization penalty
+        float lifetimeWeight = 1.f;
+        float densityWeight = 1.f;
+        float targetDensity = 0.15f;
+        float earlyStabilizationPenalty = 1.f;
+        size_t minLifetime = 50;
+    };
+
+    struct SeedScore {
+        uint32_t seed = 0;
+        float score = 0.f;
+        size_t lifetime = 0; // generations before the board became periodic (or died out)
+        size_t period = 0; // 0 if still evolving after maxGenerations
+        float meanDensity = 0.f;
+    };
+
+    struct SeedSearchResult {
+        std::vector<SeedScore> top; // best first
+        uint64_t evaluated = 0;
+        double seconds = 0.;
+    };
+
+    class SeedSearch {
+    public:
+        explicit SeedSearch(SeedSearchConfig config);
+
+        [[nodiscard]] SeedSearchResult run() const;
+        [[nodiscard]] SeedScore evaluate(uint32_t seed, CellAutomata& automata) const;
+    private:
+        SeedSearchConfig m_config;
+        CellAutomataRules m_rules;
+    };
+}